@@ -47,6 +47,7 @@ SOURCES      := AS_global.C \
                 utility/kmers-writer-stream.C \
                 utility/kmers-statistics.C \
                 utility/kmers-exact.C \
+                utility/kmers-hash.C \
                 \
                 utility/bits.C \
                 \
@@ -55,6 +56,7 @@ SOURCES      := AS_global.C \
                 utility/mt19937ar.C \
                 utility/objectStore.C \
                 utility/speedCounter.C \
+                utility/stealShop.C \
                 utility/sweatShop.C \
                 \
                 correction/computeGlobalScore.C \
@@ -106,6 +108,7 @@ SOURCES      := AS_global.C \
                 utgcns/libNDalign/NDalgorithm-reverse.C \
                 \
                 utgcns/libpbutgcns/AlnGraphBoost.C  \
+                utgcns/libpbutgcns/AlnGraphFlat.C \
                 \
                 gfa/gfa.C \
                 gfa/bed.C
@@ -212,7 +215,10 @@ SUBMAKEFILES := stores/dumpBlob.mk \
 
 ifeq ($(BUILDTESTS), 1)
 SUBMAKEFILES += utility/bitsTest.mk \
+                utility/edlibTest.mk \
                 utility/filesTest.mk \
                 utility/intervalListTest.mk \
-                utility/stddevTest.mk
+                utility/sequenceTest.mk \
+                utility/stddevTest.mk \
+                utility/stealShopTest.mk
 endif
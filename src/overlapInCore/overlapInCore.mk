@@ -10,6 +10,7 @@ endif
 TARGET   := overlapInCore
 SOURCES  := overlapInCore.C \
             overlapInCore-Build_Hash_Index.C \
+            overlapInCore-Build_Sorted_Index.C \
             overlapInCore-Find_Overlaps.C \
             overlapInCore-Output.C \
             overlapInCore-Process_Overlaps.C \